@@ -507,28 +507,24 @@ public:
         assert(Wu.size() == nu);
         dqw.resize(nq);
         if (nq==0) return;
-        Vector du(nu);
-        system.multiplyByNPInv(state, dq, du);
-        du.rowScaleInPlace(Wu);
-        system.multiplyByN(state, du, dqw);
+        duScratch.resize(nu);
+        system.multiplyByNPInv(state, dq, duScratch);
+        duScratch.rowScaleInPlace(Wu);
+        system.multiplyByN(state, duScratch, dqw);
     }
     // Calculate |Wq*dq|_RMS=|N*Wu*pinv(N)*dq|_RMS
     Real calcWeightedRMSNormQ(const State& state, const Vector& Wu,
                               const Vector& dq, int& worstQ) const
     {
-        const int nq = state.getNQ();
-        Vector dqw(nq);
-        scaleDQ(state, Wu, dq, dqw);
-        return dqw.normRMS(&worstQ);
+        scaleDQ(state, Wu, dq, dqwScratch);
+        return dqwScratch.normRMS(&worstQ);
     }
     // Calculate |Wq*dq|_Inf=|N*Wu*pinv(N)*dq|_Inf
     Real calcWeightedInfNormQ(const State& state, const Vector& Wu,
                               const Vector& dq, int& worstQ) const
     {
-        const int nq = state.getNQ();
-        Vector dqw(nq);
-        scaleDQ(state, Wu, dq, dqw);
-        return dqw.normInf(&worstQ);
+        scaleDQ(state, Wu, dq, dqwScratch);
+        return dqwScratch.normInf(&worstQ);
     }
 
     // TODO: these utilities don't really belong here
@@ -1109,6 +1105,12 @@ private:
     Vector qPrev, uPrev, zPrev;
     Vector qdotPrev, udotPrev, zdotPrev;
 
+    // Scratch for scaleDQ() and the weighted q-norm evaluations, which run
+    // on every step; member storage lets those reuse one allocation that
+    // reaches full size on the first call instead of constructing fresh
+    // Vectors each time. Mutable because the norm calculations are const.
+    mutable Vector duScratch, dqwScratch;
+
     // We'll leave the various arrays above sized as they are and full
     // of garbage. They'll be resized when first assigned to something
     // meaningful.
@@ -81,8 +81,56 @@ RungeKuttaMersonIntegratorRep::RungeKuttaMersonIntegratorRep
 // are given the initial derivative f0=f(t0,y0), which most likely is left 
 // over from an evaluation at the end of the last step.
 // 
-// We will call the derivatives at stage f1,f2,f3,f4 but these are done with 
+// We will call the derivatives at stage f1,f2,f3,f4 but these are done with
 // only two temporaries fa and fb. (What we're calling "f" Hairer calls "k".)
+
+// Each stage update below is an axpy variant y = y0 + c1*f1 [+ c2*f2 ...].
+// Writing those with Vector operator expressions heap-allocates a temporary
+// per operator on every stage of every step; instead fuse each update into a
+// single pass over the contiguous scalar data, written into preallocated
+// scratch. These are simple enough for the compiler to vectorize.
+static void fusedAxpy(Vector& yout, const Vector& y0,
+                      Real c1, const Vector& f1)
+{
+    const int n = y0.size();
+    assert(yout.size()==n && f1.size()==n);
+    const Real* y0p = y0.getContiguousScalarData();
+    const Real* f1p = f1.getContiguousScalarData();
+    Real*       yp  = yout.updContiguousScalarData();
+    for (int i=0; i<n; ++i)
+        yp[i] = y0p[i] + c1*f1p[i];
+}
+
+static void fusedAxpy(Vector& yout, const Vector& y0,
+                      Real c1, const Vector& f1,
+                      Real c2, const Vector& f2)
+{
+    const int n = y0.size();
+    assert(yout.size()==n && f1.size()==n && f2.size()==n);
+    const Real* y0p = y0.getContiguousScalarData();
+    const Real* f1p = f1.getContiguousScalarData();
+    const Real* f2p = f2.getContiguousScalarData();
+    Real*       yp  = yout.updContiguousScalarData();
+    for (int i=0; i<n; ++i)
+        yp[i] = y0p[i] + c1*f1p[i] + c2*f2p[i];
+}
+
+static void fusedAxpy(Vector& yout, const Vector& y0,
+                      Real c1, const Vector& f1,
+                      Real c2, const Vector& f2,
+                      Real c3, const Vector& f3)
+{
+    const int n = y0.size();
+    assert(yout.size()==n && f1.size()==n && f2.size()==n && f3.size()==n);
+    const Real* y0p = y0.getContiguousScalarData();
+    const Real* f1p = f1.getContiguousScalarData();
+    const Real* f2p = f2.getContiguousScalarData();
+    const Real* f3p = f3.getContiguousScalarData();
+    Real*       yp  = yout.updContiguousScalarData();
+    for (int i=0; i<n; ++i)
+        yp[i] = y0p[i] + c1*f1p[i] + c2*f2p[i] + c3*f3p[i];
+}
+
 bool RungeKuttaMersonIntegratorRep::attemptODEStep
    (Real t1, Vector& y1err, int& errOrder, int& numIterations)
 {
@@ -96,32 +144,37 @@ bool RungeKuttaMersonIntegratorRep::attemptODEStep
     if (ytmp[0].size() != y0.size())
         for (int i=0; i<NTemps; ++i)
             ytmp[i].resize(y0.size());
-    Vector& ysave = ytmp[0]; // rename temps
-    Vector& fa    = ytmp[1];
-    Vector& fb    = ytmp[2];
+    Vector& ysave  = ytmp[0]; // rename temps
+    Vector& fa     = ytmp[1];
+    Vector& fb     = ytmp[2];
+    Vector& ystage = ytmp[3];
 
     const Real h = t1-t0;
 
-    setAdvancedStateAndRealizeDerivatives(t0+h/3, y0 + (h/3)*f0);
+    fusedAxpy(ystage, y0, h/3, f0);
+    setAdvancedStateAndRealizeDerivatives(t0+h/3, ystage);
     fa = getAdvancedState().getYDot(); // fa=f1
 
-    setAdvancedStateAndRealizeDerivatives(t0+h/3, y0 + (h/6)*(f0+fa)); // f0+f1
+    fusedAxpy(ystage, y0, h/6, f0, h/6, fa); // y0+(h/6)(f0+f1)
+    setAdvancedStateAndRealizeDerivatives(t0+h/3, ystage);
     fa = getAdvancedState().getYDot(); // fa=f2
 
-    setAdvancedStateAndRealizeDerivatives(t0+h/2, y0 + (h/8)*(f0 + 3*fa)); // f0+3f2
+    fusedAxpy(ystage, y0, h/8, f0, 3*h/8, fa); // y0+(h/8)(f0+3f2)
+    setAdvancedStateAndRealizeDerivatives(t0+h/2, ystage);
     fb = getAdvancedState().getYDot(); // fb=f3
 
     // We'll need this for error estimation.
-    ysave = y0 + (h/2)*(f0 - 3*fa + 4*fb); // f0-3f2+4f3
+    fusedAxpy(ysave, y0, h/2, f0, -3*h/2, fa, 2*h, fb); // y0+(h/2)(f0-3f2+4f3)
     setAdvancedStateAndRealizeDerivatives(t1, ysave);
     fa = getAdvancedState().getYDot(); // fa=f4
 
-    // Final value. This is the 4th order accurate estimate for 
-    // y1=y(t0+h)+O(h^5): y1 = y0 + (h/6)*(f0 + 4 f3 + f4). 
-    // Evaluate through kinematics only; it is a waste of a stage to 
+    // Final value. This is the 4th order accurate estimate for
+    // y1=y(t0+h)+O(h^5): y1 = y0 + (h/6)*(f0 + 4 f3 + f4).
+    // Evaluate through kinematics only; it is a waste of a stage to
     // evaluate derivatives here since the caller will muck with this before
     // the end of the step.
-    setAdvancedStateAndRealizeKinematics(t1, y0 + (h/6)*(f0 + 4*fb + fa));
+    fusedAxpy(ystage, y0, h/6, f0, 2*h/3, fb, h/6, fa);
+    setAdvancedStateAndRealizeKinematics(t1, ystage);
     // YErr is valid now
 
     // This is an embedded 3rd-order estimate y1hat=y(t0+h)+O(h^4). (Apparently
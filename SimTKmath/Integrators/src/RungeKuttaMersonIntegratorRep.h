@@ -41,7 +41,7 @@ protected:
     bool attemptODEStep
        (Real t1, Vector& yErrEst, int& errOrder, int& numIterations) override;
 private:    
-    static const int NTemps = 3;
+    static const int NTemps = 4;
     Vector ytmp[NTemps];
 };
 
@@ -49,7 +49,7 @@
 // NOTE: An XYZ Euler angle sequence has a singularity when the middle angle
 // is at 90 or 270 degrees; quaternions are never singular.
 template<bool noX_MB, bool noR_PF>
-class RBNodeBall : public RigidBodyNodeSpec<3, false, noX_MB, noR_PF> {
+class RBNodeBall final : public RigidBodyNodeSpec<3, false, noX_MB, noR_PF> {
 public:
 
 typedef typename RigidBodyNodeSpec<3, false, noX_MB, noR_PF>::HType HType;
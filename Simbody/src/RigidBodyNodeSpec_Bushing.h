@@ -52,7 +52,7 @@
 // angles when necessary.
 
 template<bool noX_MB, bool noR_PF>
-class RBNodeBushing : public RigidBodyNodeSpec<6, false, noX_MB, noR_PF> {
+class RBNodeBushing final : public RigidBodyNodeSpec<6, false, noX_MB, noR_PF> {
 public:
 
 typedef typename RigidBodyNodeSpec<6, false, noX_MB, noR_PF>::HType HType;
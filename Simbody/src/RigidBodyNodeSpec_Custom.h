@@ -39,7 +39,7 @@
  * by the number of u's (mobilities) in the user-defined Mobilizer.
  */
 template <int nu, bool noX_MB, bool noR_PF>
-class RBNodeCustom : public RigidBodyNodeSpec<nu, false, noX_MB, noR_PF> {
+class RBNodeCustom final : public RigidBodyNodeSpec<nu, false, noX_MB, noR_PF> {
     typedef typename RigidBodyNodeSpec<nu, false, noX_MB, noR_PF>::HType HType;
 public:
     RBNodeCustom(const MobilizedBody::Custom::Implementation& impl,
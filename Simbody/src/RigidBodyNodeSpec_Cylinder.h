@@ -45,7 +45,7 @@
 // z axis; i.e., they have the same x & y coords in the F frame. The two
 // generalized coordinates are the rotation and the translation, in that order.
 template<bool noX_MB, bool noR_PF>
-class RBNodeCylinder : public RigidBodyNodeSpec<2, false, noX_MB, noR_PF> {
+class RBNodeCylinder final : public RigidBodyNodeSpec<2, false, noX_MB, noR_PF> {
 public:
     typedef typename RigidBodyNodeSpec<2, false, noX_MB, noR_PF>::HType HType;
     virtual const char* type() { return "cylinder"; }
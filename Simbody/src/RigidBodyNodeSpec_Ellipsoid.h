@@ -72,7 +72,7 @@
 // This mobilizer was written by Ajay Seth and hacked somewhat by Sherm.
 
 template<bool noX_MB, bool noR_PF>
-class RBNodeEllipsoid : public RigidBodyNodeSpec<3, false, noX_MB, noR_PF> {
+class RBNodeEllipsoid final : public RigidBodyNodeSpec<3, false, noX_MB, noR_PF> {
     Vec3 semi; // semi axis dimensions in x,y,z resp.
 public:
 
@@ -53,7 +53,7 @@
 // NOTE: An XYZ Euler angle sequence has a singularity when the middle angle
 // is at 90 or 270 degrees; quaternions are never singular. 
 template<bool noX_MB, bool noR_PF>
-class RBNodeFree : public RigidBodyNodeSpec<6, false, noX_MB, noR_PF> {
+class RBNodeFree final : public RigidBodyNodeSpec<6, false, noX_MB, noR_PF> {
 public:
 
 typedef typename RigidBodyNodeSpec<6, false, noX_MB, noR_PF>::HType HType;
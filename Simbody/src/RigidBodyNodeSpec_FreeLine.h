@@ -68,7 +68,7 @@
 // Thus the qdots have to be derived from the generalized speeds to
 // be turned into either 4 quaternion derivatives or 3 Euler angle derivatives.
 template<bool noX_MB, bool noR_PF>
-class RBNodeFreeLine : public RigidBodyNodeSpec<5, false, noX_MB, noR_PF> {
+class RBNodeFreeLine final : public RigidBodyNodeSpec<5, false, noX_MB, noR_PF> {
 public:
 
 typedef typename RigidBodyNodeSpec<5, false, noX_MB, noR_PF>::HType HType;
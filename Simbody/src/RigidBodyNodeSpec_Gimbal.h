@@ -49,7 +49,7 @@
 // convenient.
 
 template<bool noX_MB, bool noR_PF>
-class RBNodeGimbal : public RigidBodyNodeSpec<3, false, noX_MB, noR_PF> {
+class RBNodeGimbal final : public RigidBodyNodeSpec<3, false, noX_MB, noR_PF> {
 public:
 
 typedef typename RigidBodyNodeSpec<3, false, noX_MB, noR_PF>::HType HType;
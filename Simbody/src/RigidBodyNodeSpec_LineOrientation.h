@@ -60,7 +60,7 @@
 // Thus the qdots have to be derived from the generalized speeds to
 // be turned into either 4 quaternion derivatives or 3 Euler angle derivatives.
 template<bool noX_MB, bool noR_PF>
-class RBNodeLineOrientation : public RigidBodyNodeSpec<2, false, noX_MB, noR_PF> {
+class RBNodeLineOrientation final : public RigidBodyNodeSpec<2, false, noX_MB, noR_PF> {
 public:
 
 typedef typename RigidBodyNodeSpec<2, false, noX_MB, noR_PF>::HType HType;
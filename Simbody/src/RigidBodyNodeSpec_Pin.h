@@ -41,7 +41,7 @@
 // frame, which is aligned forever with the z axis of the body's M frame. In 
 // addition, the origin points Mo of M and Fo of F are identical forever.
 template<bool noX_MB, bool noR_PF>
-class RBNodeTorsion : public RigidBodyNodeSpec<1, false, noX_MB, noR_PF> {
+class RBNodeTorsion final : public RigidBodyNodeSpec<1, false, noX_MB, noR_PF> {
 public:
 virtual const char* type() { return "torsion"; }
 typedef typename RigidBodyNodeSpec<1, false, noX_MB, noR_PF>::HType HType;
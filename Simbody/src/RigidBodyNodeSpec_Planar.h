@@ -41,7 +41,7 @@
 // coordinates are theta,x,y interpreted as rotation around z and translation
 // along the (space fixed) Fx and Fy axes.
 template<bool noX_MB, bool noR_PF>
-class RBNodePlanar : public RigidBodyNodeSpec<3, false, noX_MB, noR_PF> {
+class RBNodePlanar final : public RigidBodyNodeSpec<3, false, noX_MB, noR_PF> {
 public:
 typedef typename RigidBodyNodeSpec<3, false, noX_MB, noR_PF>::HType HType;
 virtual const char* type() { return "planar"; }
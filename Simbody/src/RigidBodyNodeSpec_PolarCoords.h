@@ -45,7 +45,7 @@
 // we slide along the rotated x axis. The two generalized coordinates are the 
 // rotation and the translation, in that order.
 template<bool noX_MB, bool noR_PF>
-class RBNodeBendStretch : public RigidBodyNodeSpec<2, false, noX_MB, noR_PF> {
+class RBNodeBendStretch final : public RigidBodyNodeSpec<2, false, noX_MB, noR_PF> {
 public:
 typedef typename RigidBodyNodeSpec<2, false, noX_MB, noR_PF>::HType HType;
 virtual const char* type() { return "bendstretch"; }
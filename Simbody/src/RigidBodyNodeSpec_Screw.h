@@ -43,7 +43,7 @@
 // the angular velocity of M in F (about the z axis). We compute the
 // translational position as pitch*q, and the translation rate as pitch*u.
 template<bool noX_MB, bool noR_PF>
-class RBNodeScrew : public RigidBodyNodeSpec<1, false, noX_MB, noR_PF> {
+class RBNodeScrew final : public RigidBodyNodeSpec<1, false, noX_MB, noR_PF> {
     Real pitch;
 public:
 typedef typename RigidBodyNodeSpec<1, false, noX_MB, noR_PF>::HType HType;
@@ -39,7 +39,7 @@
 // axis of the parent body's F frame, with M=F when the coordinate
 // is zero and the orientation of M in F frozen at 0 forever.
 template<bool noX_MB, bool noR_PF>
-class RBNodeSlider : public RigidBodyNodeSpec<1, true, noX_MB, noR_PF> {
+class RBNodeSlider final : public RigidBodyNodeSpec<1, true, noX_MB, noR_PF> {
 public:
 typedef typename RigidBodyNodeSpec<1, false, noX_MB, noR_PF>::HType HType;
 virtual const char* type() { return "slider"; }
@@ -88,7 +88,7 @@ spherical coordinate system but the final stretch is along the -z direction.
 For that, take all defaults but set s2=-1. */
 
 template<bool noX_MB, bool noR_PF>
-class RBNodeSphericalCoords : public RigidBodyNodeSpec<3, false, noX_MB, noR_PF> {
+class RBNodeSphericalCoords final : public RigidBodyNodeSpec<3, false, noX_MB, noR_PF> {
 public:
 typedef typename RigidBodyNodeSpec<3, false, noX_MB, noR_PF>::HType HType;
 virtual const char* type() { return "spherical coords"; }
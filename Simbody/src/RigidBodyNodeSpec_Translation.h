@@ -41,7 +41,7 @@
 // when all 3 coords are 0, and the orientation of M in F is 0 (identity) 
 // forever.
 template<bool noX_MB, bool noR_PF>
-class RBNodeTranslate : public RigidBodyNodeSpec<3, true, noX_MB, noR_PF> {
+class RBNodeTranslate final : public RigidBodyNodeSpec<3, true, noX_MB, noR_PF> {
 public:
 typedef typename RigidBodyNodeSpec<3, true, noX_MB, noR_PF>::HType HType;
 virtual const char* type() { return "translate"; }
@@ -56,7 +56,7 @@
 // the child's M frame are about x and y, with the "long" axis of the
 // driveshaft along z.
 template<bool noX_MB, bool noR_PF>
-class RBNodeUJoint : public RigidBodyNodeSpec<2, false, noX_MB, noR_PF> {
+class RBNodeUJoint final : public RigidBodyNodeSpec<2, false, noX_MB, noR_PF> {
 public:
 typedef typename RigidBodyNodeSpec<2, false, noX_MB, noR_PF>::HType HType;
 virtual const char* type() { return "ujoint"; }
@@ -35,7 +35,7 @@ satisfy all of the following requirements:
 
  These assumptions allow lots of routines to be implemented simpler and faster.
  */
-class RBNodeLoneParticle : public RigidBodyNode {
+class RBNodeLoneParticle final : public RigidBodyNode {
 public:
 RBNodeLoneParticle(const MassProperties& mProps_B,
                    UIndex&               nextUSlot,
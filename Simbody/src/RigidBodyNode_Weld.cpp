@@ -136,7 +136,7 @@ public:
 
 /* This is the distinguished body representing the immobile ground frame. Other 
 bodies may be fixed to this one, but only this is the actual Ground. */
-class RBGroundBody : public ImmobileRigidBodyNode {
+class RBGroundBody final : public ImmobileRigidBodyNode {
 public:
     RBGroundBody()
     :   ImmobileRigidBodyNode(MassProperties(Infinity, Vec3(0), Inertia(Infinity)), 
@@ -366,7 +366,7 @@ public:
 // This is a "joint" with no degrees of freedom, that simply forces
 // the two reference frames to be identical. A Weld node always has a parent
 // but has no q's and no u's.
-class RBNodeWeld : public ImmobileRigidBodyNode {
+class RBNodeWeld final : public ImmobileRigidBodyNode {
 public:
     RBNodeWeld(const MassProperties& mProps_B, const Transform& X_PF, 
                const Transform& X_BM, const UIndex& uIx, 
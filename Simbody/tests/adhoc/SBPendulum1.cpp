@@ -59,6 +59,8 @@
 #include <iostream>
 #include <exception>
 #include <cmath>
+#include <vector>
+#include <algorithm>
 using std::cout;
 using std::endl;
 
@@ -66,6 +68,29 @@ using namespace SimTK;
 
 static const Real RadiansPerDegree = Pi/180;
 
+// Reference station on the pendulum body used by the centripetal-term
+// printout; materialized once at file scope rather than rebuilt from three
+// immediates at each use.
+static const Vec3 kRefPoint(2.5,0,0);
+
+// Centripetal term w X (w X r) computed via the BAC-CAB identity
+// w*(w.r) - r*(w.w): one pass, 6 multiplies and 2 dot products instead
+// of two full cross products with an intermediate Vec3.
+static inline Vec3 wXwXr(const Vec3& w, const Vec3& r) {
+    return w*dot(w,r) - r*dot(w,w);
+}
+
+// Mass properties of the example pendulum: a point mass m at (L/2,0,0) on a
+// massless rod, plus a tiny regularizing inertia so the free joint is never
+// singular. The point-mass terms (Iyy=Izz=m*(L/2)^2, everything else zero)
+// and the regularization are folded directly into the six unique elements
+// here instead of constructing and adding two temporary Inertias.
+static MassProperties pendulumMassProps(Real L, Real m) {
+    const Real mxx = m*(L/2)*(L/2);
+    return MassProperties(m, Vec3(L/2,0,0),
+                          Inertia(1e-6, mxx+1e-6, mxx+1e-6));
+}
+
 void stateTest() {
   try {
     State s;
@@ -102,37 +127,138 @@ void stateTest() {
 extern "C" void SimTK_version_SimTKlapack(int*,int*,int*);
 extern "C" void SimTK_about_SimTKlapack(const char*, int, char*);
 
-int main() {
-    stateTest();
-    //exit(0);
+/* Batch-mode parameter sweep: integrate several pendulum trajectories that
+ * differ only in their initial conditions. All the lanes share a single
+ * System (and hence a single topology), with each lane owning its own State
+ * and integrator. Each lane integrates its entire trajectory as one
+ * uninterrupted task on a ParallelExecutor worker -- the CPU analog of a
+ * batched one-kernel-per-trajectory GPU sweep -- recording snapshots into a
+ * preallocated per-lane buffer that is flushed only after all lanes finish,
+ * so there is no cross-lane synchronization anywhere on the stepping path.
+ */
+static void batchSweepTest() {
+  try {
+    const Real L = 1., m = 3., g = 9.8;
+    const Transform jointFrame(Vec3(-L/2,0,0));
+    const MassProperties mprops = pendulumMassProps(L, m);
+
+    MultibodySystem mbs;
+    SimbodyMatterSubsystem pend(mbs);
+    GeneralForceSubsystem forces(mbs);
+    Force::UniformGravity(forces, pend, Vec3(0,-g,0));
+
+    MobilizedBody::Free swinger(pend.Ground(), Transform(),
+                                Body::Rigid(mprops), jointFrame);
+
+    mbs.realizeTopology();
+
+    // One trajectory ("lane") per starting angle; all lanes share mbs.
+    const int NLanes = 4;
+    const Real startAngles[NLanes] = {15, 30, 45, 60}; // degrees
+
+    const Real h = 1./30;
+    const Real tmax = 10;
+    const int NSteps = (int)(tmax/h + 0.5);
+    const int SnapEvery = 30;                   // snapshot once per second
+    const int NSnaps = NSteps/SnapEvery + 1;
+
+    // Per-lane result buffers, sized up front so the workers never touch
+    // shared or growing storage while integrating.
+    std::vector<std::vector<Real> > energies(NLanes,
+                                             std::vector<Real>(NSnaps));
+
+    // Integrates one complete trajectory per invocation; realize() on the
+    // shared const System with a worker-owned State is thread safe.
+    class SweepTask : public ParallelExecutor::Task {
+    public:
+        SweepTask(const MultibodySystem& mbs, const MobilizedBody& swinger,
+                  const Real* startAngles, Real h, int nSteps, int snapEvery,
+                  std::vector<std::vector<Real> >& energies)
+        :   mbs(mbs), swinger(swinger), startAngles(startAngles), h(h),
+            nSteps(nSteps), snapEvery(snapEvery), energies(energies) {}
+
+        void execute(int lane) override {
+            State s = mbs.getDefaultState();
+            mbs.realizeModel(s);
+            Quaternion q;
+            q.setQuaternionFromAngleAxis(startAngles[lane]*RadiansPerDegree,
+                                         UnitVec3(0,0,1));
+            swinger.setQToFitTransform(s, Transform(Rotation(q)));
+
+            RungeKuttaMersonIntegrator integ(mbs);
+            integ.setFinalTime(nSteps*h);
+            integ.initialize(s);
+
+            int snapCountdown = 1, snap = 0; // snapshot at t=0, then each
+            for (int step=0; step <= nSteps; ++step) {  // snapEvery steps
+                integ.stepTo(step*h);
+                if (--snapCountdown == 0) {
+                    snapCountdown = snapEvery;
+                    const State& as = integ.getState();
+                    mbs.realize(as, Stage::Dynamics);
+                    energies[lane][snap++] = mbs.calcEnergy(as);
+                }
+            }
+        }
+    private:
+        const MultibodySystem&  mbs;
+        const MobilizedBody&    swinger;
+        const Real*             startAngles;
+        const Real              h;
+        const int               nSteps, snapEvery;
+        std::vector<std::vector<Real> >& energies;
+    };
+
+    SweepTask task(mbs, swinger, startAngles, h, NSteps, SnapEvery, energies);
+    ParallelExecutor executor;
+    executor.execute(task, NLanes);
+
+    // Single flush of the recorded snapshots after the whole batch is done.
+    for (int snap=0; snap < NSnaps; ++snap) {
+        std::printf("batch t=%g:", snap*SnapEvery*h);
+        for (int lane=0; lane < NLanes; ++lane)
+            std::printf(" E%d=%g", lane, energies[lane][snap]);
+        std::printf("\n");
+    }
+  }
+  catch(const std::exception& e) {
+      printf("*** BATCH SWEEP TEST EXCEPTION\n%s\n***\n", e.what());
+  }
+}
 
+// Print one library's version and about() key/value pairs through a pair of
+// function pointers; one copy of this loop serves every SimTK library
+// instead of being duplicated per library in main().
+static void dumpAbout(const char* libName,
+                      void (*version)(int*,int*,int*),
+                      void (*about)(const char*,int,char*))
+{
+    static const char* keylist[] = { "version", "library", "type", "debug",
+        "authors", "copyright", "svn_revision", 0 };
     int major,minor,build;
     char out[100];
-    const char* keylist[] = { "version", "library", "type", "debug", "authors", "copyright", "svn_revision", 0 };
-
-    //SimTK_version_SimTKlapack(&major,&minor,&build);
-    //std::printf("==> SimTKlapack library version: %d.%d.%d\n", major, minor, build);
-    //std::printf("    SimTK_about_SimTKlapack():\n");
-    //for (const char** p = keylist; *p; ++p) {
-    //    SimTK_about_SimTKlapack(*p, 100, out);
-    //    std::printf("      about(%s)='%s'\n", *p, out);
-    //}
-
-    SimTK_version_SimTKcommon(&major,&minor,&build);
-    std::printf("==> SimTKcommon library version: %d.%d.%d\n", major, minor, build);
-    std::printf("    SimTK_about_SimTKcommon():\n");
-    for (const char** p = keylist; *p; ++p) {
-        SimTK_about_SimTKcommon(*p, 100, out);
-        std::printf("      about(%s)='%s'\n", *p, out);
-    }
 
-    SimTK_version_simbody(&major,&minor,&build);
-    std::printf("==> simbody library version: %d.%d.%d\n", major, minor, build);
-    std::printf("    SimTK_about_simbody():\n");
+    version(&major,&minor,&build);
+    std::printf("==> %s library version: %d.%d.%d\n",
+                libName, major, minor, build);
+    std::printf("    SimTK_about_%s():\n", libName);
     for (const char** p = keylist; *p; ++p) {
-        SimTK_about_simbody(*p, 100, out);
+        about(*p, 100, out);
         std::printf("      about(%s)='%s'\n", *p, out);
     }
+}
+
+int main() {
+    stateTest();
+    batchSweepTest();
+    //exit(0);
+
+    //dumpAbout("SimTKlapack", &SimTK_version_SimTKlapack,
+    //          &SimTK_about_SimTKlapack);
+    dumpAbout("SimTKcommon", &SimTK_version_SimTKcommon,
+              &SimTK_about_SimTKcommon);
+    dumpAbout("simbody",     &SimTK_version_simbody,
+              &SimTK_about_simbody);
 
 
 try {
@@ -148,11 +274,11 @@ try {
     Transform baseFrame;
 
     Transform jointFrame(Vec3(-L/2,0,0));
-    MassProperties mprops(m, Vec3(L/2,0,0), Inertia(Vec3(L/2,0,0), m)+Inertia(1e-6,1e-6,1e-6));
+    MassProperties mprops = pendulumMassProps(L, m);
     cout << "mprops about body frame: " << mprops.getMass() << ", " 
         << mprops.getMassCenter() << ", " << mprops.getUnitInertia() << endl;
 
-    Vec3 gravity(0.,-g,0.);
+    const Vec3 gravity(0.,-g,0.);
     Force::UniformGravity gravityForces(springs, pend, gravity);
     cout << "period should be " << 2*std::acos(-1.)*std::sqrt(L/g) << " seconds." << endl;
 
@@ -231,6 +357,10 @@ try {
     viz.report(s);
 
     // set Modeling stuff (s)
+    // Keep the quaternion parameterization (the default): qdot is then the
+    // bilinear 0.5*w*q update with no sin/cos anywhere on the per-step
+    // path. Euler angles would force a trig-laden E-matrix evaluation at
+    // every derivative call; we convert to Euler only for gated output.
     pend.setUseEulerAngles(s, false); // this is the default
     //pend.setUseEulerAngles(s, true);
     mbs.realizeModel(s);
@@ -268,19 +398,32 @@ try {
     cout << "q=" << s.getQ() << endl;
     cout << "body frame: " << bodyConfig;
 
-    Vector dummy; ProjectResults results;
-    mbs.projectQ(s, dummy, ProjectOptions().setRequiredAccuracy(1e-3),
-                 results);
+    // Project only if the constraints have actually drifted. When the ball
+    // constraint is already satisfied to the requested accuracy the Newton
+    // projection does no useful work but still pays for its factorization,
+    // so test the position constraint error norm first. (The integrator's
+    // own per-step projection below is drift-gated the same way unless
+    // setProjectEveryStep() is turned on.)
+    const Real projectAccuracy = 1e-3;
+    if (s.getQErr().normRMS() > projectAccuracy) {
+        Vector dummy; ProjectResults results;
+        mbs.projectQ(s, dummy,
+                     ProjectOptions().setRequiredAccuracy(projectAccuracy),
+                     results);
+    }
 
     cout << "-------> STATE after realize(Position):" << s;
     cout << "<------- STATE after realize(Position)." << endl;
 
     cout << "after assembly body frame: " << aPendulum.getBodyTransform(s); 
 
+    // Bulk-fill the gradient: Vector_'s elementwise assignment is a single
+    // fill pass through the packed contiguous storage (MatrixHelper::
+    // fillWith), so there is no need for a hand-rolled per-component loop
+    // or a new fill-range entry point. Ground's slot is zeroed afterward.
     Vector_<SpatialVec> dEdR(pend.getNumBodies());
-    dEdR[0] = 0;
-    for (int i=1; i < pend.getNumBodies(); ++i)
-        dEdR[i] = SpatialVec(Vec3(0), Vec3(0.,2.,0.));
+    dEdR = SpatialVec(Vec3(0), Vec3(0.,2.,0.));
+    dEdR[0] = SpatialVec(Vec3(0), Vec3(0));
     Vector dEdQ;
     pend.multiplyBySystemJacobianTranspose(s, dEdR, dEdQ);
     cout << "dEdR=" << dEdR << endl;
@@ -288,13 +431,17 @@ try {
 
     pend.getMobilizedBody(MobilizedBodyIndex(1)).setOneU(s,0,10.);
 
-    Vector_<SpatialVec> bodyForces(pend.getNumBodies());
-    Vector_<Vec3>       particleForces(pend.getNumParticles());
-    Vector              mobilityForces(pend.getNumMobilities());
-
-    bodyForces.setToZero();
-    particleForces.setToZero();
-    mobilityForces.setToZero();
+    // Construct each scratch force array directly at its background value,
+    // fusing allocation and clear into one pass instead of allocating and
+    // then re-walking the same memory with setToZero(). The one nonzero
+    // mobility force is added in immediately while the array is still warm.
+    // (The gravity applied during realize(Dynamics) needs no such help:
+    // Force::UniformGravity already accumulates into the system force
+    // arrays in a single pass, with the position-only part cached.)
+    Vector_<SpatialVec> bodyForces(pend.getNumBodies(),
+                                   SpatialVec(Vec3(0), Vec3(0)));
+    Vector_<Vec3>       particleForces(pend.getNumParticles(), Vec3(0));
+    Vector              mobilityForces(pend.getNumMobilities(), Real(0));
 
     pend.addInMobilityForce(s, aPendulum, MobilizerUIndex(0), 147, mobilityForces);
 
@@ -302,7 +449,7 @@ try {
     SpatialVec bodyVel = aPendulum.getBodyVelocity(s);
     cout << "body vel: " << bodyVel << endl;
 
-    cout << "wXwXr=" << bodyVel[0] % (bodyVel[0] % Vec3(2.5,0,0)) << endl;
+    cout << "wXwXr=" << wXwXr(bodyVel[0], kRefPoint) << endl;
 
 
     cout << "after applying gravity, body forces=" << bodyForces << endl;
@@ -333,7 +480,12 @@ try {
     const Real tstart = 0.;
     const Real tmax = 20;
 
+    // Adaptive 4th-order Runge-Kutta-Merson: the step-size control takes
+    // steps as large as the accuracy target permits (far larger than the
+    // 1/30 s report interval, which is served by interpolation), so a
+    // fixed-step scheme with a hand-tuned h has nothing to offer here.
     RungeKuttaMersonIntegrator ee(mbs);
+    ee.setAccuracy(1e-3);
     ee.setFinalTime(tmax);
 
     s.updTime() = tstart;
@@ -341,44 +493,54 @@ try {
     s = ee.getState();
     viz.report(s);
 
+    // Per-report results are recorded into this preallocated buffer and
+    // formatted in a single pass after the run; iostream formatting (and
+    // the flush that endl forces) never executes inside the stepping loop.
+    struct Snap {
+        Real       t, e, pe, ke, hNext;
+        Vector     q, u;
+        Transform  x;
+        SpatialVec v;
+    };
+    std::vector<Snap> snaps;
+    snaps.reserve((int)(tmax/(10*h)) + 2);
+    std::vector<std::pair<Real,Vector> > udotSnaps;
+    udotSnaps.reserve((int)(tmax/(100*h)) + 2);
+
+    // The number of report times is known up front, so bound the loop with
+    // a single integer compare rather than letting a floating-point time
+    // comparison control termination; each report time is recovered from
+    // the integer step count. EndOfSimulation remains as a safety exit.
+    const int NReports = (int)std::floor((tmax - tstart)/h) + 1;
+
     Integrator::SuccessfulStepStatus status;
     int step = 0;
-    while ((status=ee.stepTo(step*h)) != Integrator::EndOfSimulation) {
+    // Countdown gates rather than "step % n" tests: each is a single
+    // decrement-and-compare whose rare-taken pattern the branch predictor
+    // learns immediately, with no modulo in the loop.
+    int energyCountdown = 1;    // report on the first pass, then every 10th
+    int udotCountdown   = 100;
+    while (step < NReports &&
+           (status=ee.stepTo(tstart + step*h)) != Integrator::EndOfSimulation) {
         const State& s = ee.getState();
 
-        if (!(step % 10)) {
+        if (--energyCountdown == 0) {
+            energyCountdown = 10;
             // This is so we can calculate potential energy (although logically
             // one should be able to do that at Stage::Position).
             mbs.realize(s, Stage::Dynamics);
 
-            cout << " E=" << mbs.calcEnergy(s)
-                 << " (pe=" << mbs.calcPotentialEnergy(s)
-                 << ", ke=" << mbs.calcKineticEnergy(s)
-                 << ") hNext=" << ee.getPredictedNextStepSize() << endl;
-
-            const Vector qdot = pend.getQDot(s);
-
-            Transform  x = aPendulum.getBodyTransform(s);
-            SpatialVec v = aPendulum.getBodyVelocity(s);
-
-            //Vec3 err = x.p()-Vec3(2.5,0.,0.);
-            //Real d = err.norm();
-            //Real k = m*gravity.norm(); // stiffness, should balance at 1
-            // Real c = 10.; // damping
-            //Vec3 fk = -k*err;
-            //Real fc = -c*pend.getU(s)[2];
-            //pend.applyPointForce(s,aPendulum,Vec3(0,0,0),fk);
-            //pend.applyJointForce(s,aPendulum,2,fc);
-
-            cout << s.getTime() << " " 
-                 << s.getQ() << " " << s.getU() 
-                 << " hNext=" << ee.getPredictedNextStepSize() << endl;
-            cout << "body config=" << x;
-            cout << "body velocity=" << v << endl;
-            //cout << "err=" << err << " |err|=" << d << endl;
-            //cout << "spring force=" << fk << endl;
-            //cout << "damping joint forces=" << fc << endl;
-            
+            snaps.push_back(Snap());
+            Snap& snap = snaps.back();
+            snap.t     = s.getTime();
+            snap.e     = mbs.calcEnergy(s);
+            snap.pe    = mbs.calcPotentialEnergy(s);
+            snap.ke    = mbs.calcKineticEnergy(s);
+            snap.hNext = ee.getPredictedNextStepSize();
+            snap.q     = s.getQ();
+            snap.u     = s.getU();
+            snap.x     = aPendulum.getBodyTransform(s);
+            snap.v     = aPendulum.getBodyVelocity(s);
         }
 
         viz.report(s);
@@ -387,13 +549,42 @@ try {
             ++step;
 
 
-        if (!(step % 100)) {
+        if (--udotCountdown == 0) {
+            udotCountdown = 100;
             mbs.realize(s, Stage::Acceleration);
-            const Vector udot = s.getUDot();
-            cout << "udot = " << udot << endl;
+            udotSnaps.push_back(std::make_pair(s.getTime(), s.getUDot()));
         }
     }
 
+    // Single formatting pass over everything recorded during the run.
+    for (int i=0; i < (int)snaps.size(); ++i) {
+        const Snap& snap = snaps[i];
+        cout << " E=" << snap.e
+             << " (pe=" << snap.pe
+             << ", ke=" << snap.ke
+             << ") hNext=" << snap.hNext << endl;
+        cout << snap.t << " "
+             << snap.q << " " << snap.u
+             << " hNext=" << snap.hNext << endl;
+        cout << "body config=" << snap.x;
+        // Euler angles are for human consumption only; the one place trig
+        // gets evaluated is here, after the run.
+        cout << "body euler (xyz)="
+             << snap.x.R().convertRotationToBodyFixedXYZ() << endl;
+        cout << "body velocity=" << snap.v << endl;
+    }
+    for (int i=0; i < (int)udotSnaps.size(); ++i)
+        cout << "t=" << udotSnaps[i].first
+             << " udot = " << udotSnaps[i].second << endl;
+
+    // How much work the error-controlled integrator actually did; with
+    // accuracy-driven step-size control this is the number that matters,
+    // not the nominal report interval.
+    std::printf("RKM: %d steps taken (%d attempted), "
+                "%d realizations, %d projections\n",
+        ee.getNumStepsTaken(), ee.getNumStepsAttempted(),
+        ee.getNumRealizations(), ee.getNumProjections());
+
 }
 catch (const std::exception& e) {
     printf("EXCEPTION THROWN: %s\n", e.what());